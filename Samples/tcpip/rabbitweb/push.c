@@ -0,0 +1,165 @@
+/*
+   Copyright (c) 2015, Digi International Inc.
+
+   Permission to use, copy, modify, and/or distribute this software for any
+   purpose with or without fee is hereby granted, provided that the above
+   copyright notice and this permission notice appear in all copies.
+
+   THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+   WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+   MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+   ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+   WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+   ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+   OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+/*******************************************************************************
+        Samples\TcpIp\RabbitWeb\push.c
+
+        Demonstrates a live dashboard which is updated by pushing just the
+        changed #web variables to the browser, instead of having the page
+        reload (or poll) every second.
+
+        The page opens a Server-Sent Events stream at /push (handled by
+        rweb_push()), and each event is a JSON object of the variables
+        which have changed since the last one.  The simulated sensor
+        readings below change at different rates, and each change is
+        reported with web_changed().  The alarm limit is changed with the
+        form on the page: variables changed by a form are sent to all
+        the connected browsers without any extra code.
+
+        Open the page in two browser windows, change the limit in one,
+        and watch it change in the other.
+
+        NOTE: this needs a browser which supports EventSource (any
+        current browser except Internet Explorer).
+
+        See:
+        samples\tcpip\rabbitweb\pages\push.zhtml
+
+*******************************************************************************/
+
+/***********************************
+ * Configuration                   *
+ * -------------                   *
+ * All fields in this section must *
+ * be altered to match your local  *
+ * network settings.               *
+ ***********************************/
+
+/*
+ * NETWORK CONFIGURATION
+ * Please see the function help (Ctrl-H) on TCPCONFIG for instructions on
+ * compile-time network configuration.
+ */
+#define TCPCONFIG 1
+
+/*
+ * Each browser showing the page keeps one server busy with its event
+ * stream, so allow for a couple of browsers plus the page requests.
+ */
+#define HTTP_MAXSERVERS 4
+#define MAX_TCP_SOCKET_BUFFERS 4
+
+/********************************
+ * End of configuration section *
+ ********************************/
+
+/*
+ * This is needed to be able to use the RabbitWeb HTTP enhancements and the
+ * ZHTML scripting language.
+ */
+#define USE_RABBITWEB 1
+
+#memmap xmem
+
+#use "dcrtcp.lib"
+#use "http.lib"
+
+#ximport "samples/tcpip/rabbitweb/pages/push.zhtml"	push_zhtml
+
+/* The default mime type for '/' must be first */
+SSPEC_MIMETABLE_START
+   // This handler enables the ZHTML parser to be used on ZHTML files...
+	SSPEC_MIME_FUNC(".zhtml", "text/html", zhtml_handler),
+	SSPEC_MIME(".html", "text/html")
+SSPEC_MIMETABLE_END
+
+/* Associate the #ximported file and the event stream with the web server */
+SSPEC_RESOURCETABLE_START
+	SSPEC_RESOURCE_XMEMFILE("/", push_zhtml),
+	SSPEC_RESOURCE_XMEMFILE("/index.zhtml", push_zhtml),
+	SSPEC_RESOURCE_FUNCTION("/push", rweb_push)
+SSPEC_RESOURCETABLE_END
+
+/*
+ * Variables to be registered.  The sensor readings are read-only to the
+ * browser, the alarm limit can be changed with the form.
+ */
+int temperature;		// Tenths of a degree C
+int pressure;			// hPa
+long uptime;			// Seconds
+struct {
+	int on;				// Set when temperature exceeds the limit
+	int limit;			// Tenths of a degree C
+} alarm;
+
+#web temperature groups=all(ro)
+#web pressure groups=all(ro)
+#web uptime groups=all(ro)
+#web alarm groups=all(ro)
+#web alarm.limit ($alarm.limit >= 0 && $alarm.limit <= 500 || \
+				web_error("limit must be 0..500")) groups=all(rw)
+
+
+void main(void)
+{
+	unsigned long t_temp, t_press, t_up;
+	int on;
+
+	temperature = 215;
+	pressure = 1013;
+	uptime = 0;
+	alarm.limit = 250;
+	alarm.on = 0;
+
+	// Initialize the TCP/IP stack and HTTP server
+	// Start network and wait for interface to come up (or error exit).
+	sock_init_or_exit(1);
+   http_init();
+
+	// This yields a performance improvement for an HTTP server
+	tcp_reserveport(80);
+
+	t_temp = t_press = t_up = MS_TIMER;
+   while (1) {
+		// Drive the HTTP server
+      http_handler();
+
+		// Simulated sensors.  Each change is reported with web_changed(),
+		// so that it is pushed to the browsers.
+		if (MS_TIMER - t_temp >= 300) {
+			t_temp = MS_TIMER;
+			temperature += (rand() % 7) - 3;
+			web_changed("temperature");
+		}
+		if (MS_TIMER - t_press >= 5000) {
+			t_press = MS_TIMER;
+			pressure += (rand() % 3) - 1;
+			web_changed("pressure");
+		}
+		if (MS_TIMER - t_up >= 1000) {
+			t_up += 1000;
+			++uptime;
+			web_changed("uptime");
+		}
+
+		// Only report the alarm when it changes
+		on = temperature > alarm.limit;
+		if (on != alarm.on) {
+			alarm.on = on;
+			web_changed("alarm.on");
+		}
+   }
+}
+